@@ -58,6 +58,9 @@ public:
 
     // Evaluation of B-spline
     double eval(DenseVector x) const override;
+
+    // Evaluation of B-spline at the columns of x (numVariables x numPoints)
+    DenseVector evalBatch(const DenseMatrix &x) const;
     DenseMatrix evalJacobian(DenseVector x) const override;
     DenseMatrix evalHessian(DenseVector x) const override;
 
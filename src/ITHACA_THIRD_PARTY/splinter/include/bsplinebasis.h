@@ -24,6 +24,7 @@ public:
 
     // Evaluation
     SparseVector eval(const DenseVector &x) const;
+    SparseMatrix evalBatch(const DenseMatrix &x) const; // Points stored column-wise
     DenseMatrix evalBasisJacobianOld(DenseVector &x) const; // Depricated
     SparseMatrix evalBasisJacobian(DenseVector &x) const;
     SparseMatrix evalBasisJacobian2(DenseVector &x) const; // A bit slower than evaBasisJacobianOld()
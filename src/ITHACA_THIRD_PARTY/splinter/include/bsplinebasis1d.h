@@ -26,6 +26,9 @@ public:
     SparseVector evalDerivative(double x, int r) const;
     SparseVector evalFirstDerivative(double x) const; // Depricated
 
+    // Evaluation at many ascending points, one row of degree+1 values per point
+    void evalBatch(const std::vector<double> &x, std::vector<int> &firstIndex, DenseMatrix &values) const;
+
     // Knot vector related
     SparseMatrix refineKnots();
     SparseMatrix refineKnotsLocally(double x);
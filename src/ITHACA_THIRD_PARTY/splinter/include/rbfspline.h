@@ -121,17 +121,44 @@ public:
     RBFSpline(const DataTable &samples, RadialBasisFunctionType type, bool normalized, double e=1.0);
     RBFSpline(const DataTable& samples, RadialBasisFunctionType type, DenseMatrix w, double e=1.0);
 
+    /*
+     * Multi-output constructor. Builds one interpolant for each column of y,
+     * where the rows of y follow the order of the samples in the DataTable.
+     * The interpolation matrix is assembled and factored once for all the
+     * outputs: Cholesky (LDLT if it fails) for the positive definite kernels,
+     * column pivoting QR otherwise. If choleskyFactor is given (e.g. from a
+     * previous run) only the triangular solves are carried out. Every solution
+     * must satisfy |A w - b| <= 1e-8 |b|, otherwise the next solver is used.
+     * eval and evalBatch need a single output: use the columns of weights
+     * to build one spline per output.
+     */
+    RBFSpline(const DataTable& samples, RadialBasisFunctionType type, const DenseMatrix& y,
+              bool normalized, double e=1.0, const DenseMatrix& choleskyFactor=DenseMatrix());
+
     virtual RBFSpline* clone() const { return new RBFSpline(*this); }
 
     double eval(DenseVector x) const;
     double eval(std::vector<double> x) const;
 
+    /*
+     * Evaluates the spline at many points at once. Each column of x is a
+     * point (dim x numPoints), the result holds one value per column.
+     */
+    DenseVector evalBatch(const DenseMatrix &x) const;
+
     DenseMatrix evalJacobian(DenseVector x) const {}; // TODO: implement via RBF_fn
     DenseMatrix evalHessian(DenseVector x) const {}; // TODO: implement via RBF_fn
     //    std::vector<double> getDomainUpperBound() const;
     //    std::vector<double> getDomainLowerBound() const;
     DenseMatrix weights;
 
+    /*
+     * Lower Cholesky factor of the interpolation matrix, filled by the
+     * multi-output constructor when the Cholesky weights pass the residual
+     * check, empty otherwise
+     */
+    DenseMatrix choleskyFactor;
+
     unsigned int getNumVariables() const { return dim; }
 
 private:
@@ -142,6 +169,19 @@ private:
 
     std::shared_ptr<RadialBasisFunction> fn;
 
+    /*
+     * Centers of the samples stored column-wise (dim x numSamples), in the
+     * same order as the weights, together with the kernel type and shape
+     * parameter. They are used by eval to avoid walking the DataTable and
+     * the virtual call to fn->eval for every center.
+     */
+    DenseMatrix centers;
+    RadialBasisFunctionType type;
+    double shape;
+
+    void setKernel(RadialBasisFunctionType type, double e);
+    void flattenCenters();
+    void evalKernel(const DenseVector &x, DenseVector &phi) const;
 
     DenseMatrix computePreconditionMatrix() const;
 